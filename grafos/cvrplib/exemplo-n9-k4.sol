@@ -0,0 +1,5 @@
+Route #1: 6 8
+Route #2: 3 5
+Route #3: 2
+Route #4: 1 4 7
+Cost 360
@@ -36,6 +36,32 @@ def gerar_entradas_grafo(num_nos, max_peso=100, probabilidade=0.25):
 
     return grafo
 
+def gerar_instancia_cvrplib(nome_arquivo, num_clientes, capacidade, max_coord=1000, max_demanda=10):
+    """
+    Gera uma instância no formato CVRPLIB/TSPLIB (coordenadas EUC_2D), com o depósito no nó 1.
+    Não guarda arestas: o custo entre dois locais é a distância euclidiana arredondada.
+
+    :param nome_arquivo: Caminho do arquivo .vrp a ser escrito.
+    :param num_clientes: Número de clientes, excluindo o depósito.
+    :param capacidade: Capacidade do veículo.
+    :param max_coord: Valor máximo das coordenadas X e Y.
+    :param max_demanda: Demanda máxima de cada cliente.
+    """
+    dimensao = num_clientes + 1
+    with open(nome_arquivo, 'w') as arquivo:
+        arquivo.write(f"NAME : {nome_arquivo.split('/')[-1].rsplit('.', 1)[0]}\n")
+        arquivo.write("TYPE : CVRP\n")
+        arquivo.write(f"DIMENSION : {dimensao}\n")
+        arquivo.write("EDGE_WEIGHT_TYPE : EUC_2D\n")
+        arquivo.write(f"CAPACITY : {capacidade}\n")
+        arquivo.write("NODE_COORD_SECTION\n")
+        for no in range(1, dimensao + 1):
+            arquivo.write(f"{no} {random.randint(0, max_coord)} {random.randint(0, max_coord)}\n")
+        arquivo.write("DEMAND_SECTION\n")
+        for no in range(1, dimensao + 1):
+            arquivo.write(f"{no} {0 if no == 1 else random.randint(1, max_demanda)}\n")
+        arquivo.write("DEPOT_SECTION\n1\n-1\nEOF\n")
+
 ############################################
 #             Exemplo de uso
 ############################################
@@ -54,3 +80,6 @@ with open('grafo_51.txt', 'w') as arquivo:
   for aresta, peso in grafo.items():
     linha = f"{aresta[0]} {aresta[1]} {peso}\n" # Trio: ORIGEM DESTINO CUSTO
     arquivo.write(linha)
+
+# Instância grande em coordenadas para o n_insertion_cvrplib.cpp
+# gerar_instancia_cvrplib('cvrplib/gerado-n50001.vrp', 50000, 100)
@@ -0,0 +1,311 @@
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <algorithm>
+#include <iomanip>
+#include <climits>
+#include <cmath>
+#include <string>
+
+using namespace std;
+
+using Local = int;
+using Carga = int;
+using Custo = int;
+using CustoTotal = long long;  // Soma de dezenas de milhares de arestas pode passar de INT_MAX
+
+struct Caminho {
+    vector<Local> trajeto;
+    CustoTotal custoTotal;
+
+    Caminho(vector<Local> trajeto, CustoTotal custoTotal)
+        : trajeto(move(trajeto)), custoTotal(custoTotal) {}
+};
+
+// Instancia no formato CVRPLIB/TSPLIB (.vrp). O deposito sempre fica no indice 0 e os
+// clientes em 1..dimensao-1, como nos grafos/*.txt.
+struct Instancia {
+    int dimensao = 0;                // Numero de locais, incluindo o deposito
+    Carga capacidade = 0;
+    bool arredondarParaCima = false; // CEIL_2D em vez de EUC_2D
+    vector<double> x, y;
+    vector<Carga> demandas;
+    CustoTotal custoOtimo = -1;      // Lido do .sol, quando existir
+};
+
+// Distancias calculadas sob demanda a partir das coordenadas, sem guardar a matriz n x n.
+// Segue o arredondamento do TSPLIB: nint(sqrt(dx^2 + dy^2)) ou ceil no caso CEIL_2D.
+class DistanciaImplicita {
+public:
+    DistanciaImplicita(const vector<double>& x, const vector<double>& y, bool arredondarParaCima)
+        : x(x), y(y), arredondarParaCima(arredondarParaCima) {}
+
+    Custo operator()(Local origem, Local destino) const {
+        double dx = x[origem] - x[destino];
+        double dy = y[origem] - y[destino];
+        double d = sqrt(dx * dx + dy * dy);
+        return arredondarParaCima ? (Custo)ceil(d) : (Custo)(d + 0.5);
+    }
+
+    // Calcula em lote a distancia de um local para n coordenadas contiguas. Os vetores
+    // estao em SoA para que o compilador gere instrucoes SIMD; compile com
+    // -O3 -march=native -fopenmp-simd -fno-math-errno (sem o ultimo, sqrt impede a vetorizacao).
+    void calcularLote(Local origem, const double* xs, const double* ys, int n, Custo* saida) const {
+        const double ox = x[origem];
+        const double oy = y[origem];
+        const bool paraCima = arredondarParaCima;
+
+        #pragma omp simd
+        for (int i = 0; i < n; ++i) {
+            double dx = ox - xs[i];
+            double dy = oy - ys[i];
+            double d = sqrt(dx * dx + dy * dy);
+            saida[i] = (Custo)(paraCima ? ceil(d) : d + 0.5);
+        }
+    }
+
+private:
+    const vector<double>& x;
+    const vector<double>& y;
+    bool arredondarParaCima;
+};
+
+class OtimizadorDeRota {
+public:
+    Caminho melhorCaminho = Caminho({}, LLONG_MAX);
+
+    OtimizadorDeRota(const Instancia& instancia)
+        : instancia(instancia), distancia(instancia.x, instancia.y, instancia.arredondarParaCima) {}
+
+    bool calcularMelhorRota() {
+        // Os locais ainda nao visitados ficam compactados em vetores paralelos; ao visitar um
+        // local ele e trocado com o ultimo, entao cada passo so percorre os pendentes.
+        int totalPendentes = instancia.dimensao - 1;
+        pendentesId.resize(totalPendentes);
+        pendentesX.resize(totalPendentes);
+        pendentesY.resize(totalPendentes);
+        pendentesDemanda.resize(totalPendentes);
+        custosLote.resize(totalPendentes);
+
+        for (int i = 0; i < totalPendentes; ++i) {
+            pendentesId[i] = i + 1;
+            pendentesX[i] = instancia.x[i + 1];
+            pendentesY[i] = instancia.y[i + 1];
+            pendentesDemanda[i] = instancia.demandas[i + 1];
+        }
+
+        Caminho caminhoInicial({0}, 0);
+        caminhoInicial.trajeto.reserve(instancia.dimensao * 2);
+        if (!construirRota(0, 0, caminhoInicial))
+            return false;
+        melhorCaminho = caminhoInicial;
+        return true;
+    }
+
+private:
+    const Instancia& instancia;
+    DistanciaImplicita distancia;
+    vector<Local> pendentesId;
+    vector<double> pendentesX, pendentesY;
+    vector<Carga> pendentesDemanda;
+    vector<Custo> custosLote;
+
+    bool construirRota(Carga cargaAtual, Local ultimoLocal, Caminho& caminhoAtual) {
+        int totalPendentes = (int)pendentesId.size();
+
+        while (totalPendentes > 0) {
+            distancia.calcularLote(ultimoLocal, pendentesX.data(), pendentesY.data(), totalPendentes, custosLote.data());
+
+            // Descarta quem estouraria a capacidade sem desviar do laco vetorizado
+            Carga folga = instancia.capacidade - cargaAtual;
+            #pragma omp simd
+            for (int i = 0; i < totalPendentes; ++i)
+                custosLote[i] = pendentesDemanda[i] <= folga ? custosLote[i] : INT_MAX;
+
+            // Empate resolvido pelo menor indice, como no n_insertion.cpp
+            int melhor = -1;
+            Custo menorCusto = INT_MAX;
+            for (int i = 0; i < totalPendentes; ++i) {
+                if (custosLote[i] < menorCusto || (custosLote[i] == menorCusto && melhor != -1 && pendentesId[i] < pendentesId[melhor])) {
+                    melhor = i;
+                    menorCusto = custosLote[i];
+                }
+            }
+
+            if (melhor == -1) {
+                if (ultimoLocal == 0) {
+                    cerr << "Nenhum local pendente cabe no veiculo vazio" << endl;
+                    return false;
+                }
+                caminhoAtual.trajeto.push_back(0);
+                caminhoAtual.custoTotal += distancia(ultimoLocal, 0);
+                ultimoLocal = 0;
+                cargaAtual = 0;
+            } else {
+                Local proxLocal = pendentesId[melhor];
+                caminhoAtual.trajeto.push_back(proxLocal);
+                caminhoAtual.custoTotal += menorCusto;
+                cargaAtual += pendentesDemanda[melhor];
+                ultimoLocal = proxLocal;
+
+                totalPendentes--;
+                pendentesId[melhor] = pendentesId[totalPendentes];
+                pendentesX[melhor] = pendentesX[totalPendentes];
+                pendentesY[melhor] = pendentesY[totalPendentes];
+                pendentesDemanda[melhor] = pendentesDemanda[totalPendentes];
+            }
+        }
+
+        if (ultimoLocal != 0) {
+            caminhoAtual.trajeto.push_back(0);
+            caminhoAtual.custoTotal += distancia(ultimoLocal, 0);
+        }
+        return true;
+    }
+};
+
+// Le o custo da linha "Cost <valor>" do arquivo .sol do CVRPLIB, se ele existir.
+CustoTotal lerCustoOtimo(const string& nomeArquivo) {
+    string nomeSolucao = nomeArquivo;
+    size_t ponto = nomeSolucao.rfind('.');
+    if (ponto != string::npos)
+        nomeSolucao.erase(ponto);
+    nomeSolucao += ".sol";
+
+    ifstream arquivo(nomeSolucao);
+    string linha;
+    while (getline(arquivo, linha)) {
+        istringstream iss(linha);
+        string chave;
+        CustoTotal custo;
+        if (iss >> chave && (chave == "Cost" || chave == "cost") && iss >> custo)
+            return custo;
+    }
+    return -1;
+}
+
+bool lerInstancia(const string& nomeArquivo, Instancia& instancia) {
+    ifstream arquivo(nomeArquivo);
+    if (!arquivo.is_open()) {
+        cerr << "Erro ao abrir arquivo: " << nomeArquivo << endl;
+        return false;
+    }
+
+    vector<double> xArquivo, yArquivo;
+    vector<Carga> demandasArquivo;
+    Local deposito = 1;
+    string linha;
+
+    while (getline(arquivo, linha)) {
+        // Cabecalho no formato "CHAVE : VALOR" (com ou sem espacos ao redor de ':')
+        size_t separador = linha.find(':');
+        string chave = linha.substr(0, separador);
+        chave.erase(remove_if(chave.begin(), chave.end(), ::isspace), chave.end());
+        string valor = separador == string::npos ? "" : linha.substr(separador + 1);
+        valor.erase(remove_if(valor.begin(), valor.end(), ::isspace), valor.end());
+
+        if (chave == "DIMENSION") {
+            instancia.dimensao = stoi(valor);
+            xArquivo.assign(instancia.dimensao + 1, 0.0);
+            yArquivo.assign(instancia.dimensao + 1, 0.0);
+            demandasArquivo.assign(instancia.dimensao + 1, 0);
+        } else if (chave == "CAPACITY") {
+            instancia.capacidade = stoi(valor);
+        } else if (chave == "EDGE_WEIGHT_TYPE") {
+            if (valor == "CEIL_2D") {
+                instancia.arredondarParaCima = true;
+            } else if (valor != "EUC_2D") {
+                cerr << "EDGE_WEIGHT_TYPE nao suportado: " << valor << endl;
+                return false;
+            }
+        } else if (chave == "NODE_COORD_SECTION" || chave == "DEMAND_SECTION") {
+            if (instancia.dimensao <= 0) {
+                cerr << "DIMENSION deve vir antes de " << chave << endl;
+                return false;
+            }
+            bool coordenadas = chave == "NODE_COORD_SECTION";
+            for (int i = 0; i < instancia.dimensao; ++i) {
+                getline(arquivo, linha);
+                istringstream iss(linha);
+                Local local;
+                iss >> local;
+                if (local < 1 || local > instancia.dimensao) {
+                    cerr << "Local fora do intervalo em " << chave << ": " << local << endl;
+                    return false;
+                }
+                if (coordenadas)
+                    iss >> xArquivo[local] >> yArquivo[local];
+                else
+                    iss >> demandasArquivo[local];
+            }
+        } else if (chave == "DEPOT_SECTION") {
+            // Lista terminada por -1; so um deposito e suportado
+            arquivo >> deposito;
+        } else if (chave == "EOF") {
+            break;
+        }
+    }
+
+    if (instancia.dimensao < 2 || instancia.capacidade <= 0 || deposito < 1 || deposito > instancia.dimensao) {
+        cerr << "Instancia invalida: " << nomeArquivo << endl;
+        return false;
+    }
+
+    // Renumera para deixar o deposito em 0 e os clientes em sequencia
+    instancia.x.resize(instancia.dimensao);
+    instancia.y.resize(instancia.dimensao);
+    instancia.demandas.resize(instancia.dimensao);
+    for (Local local = 1; local <= instancia.dimensao; ++local) {
+        Local interno = local == deposito ? 0 : (local < deposito ? local : local - 1);
+        instancia.x[interno] = xArquivo[local];
+        instancia.y[interno] = yArquivo[local];
+        instancia.demandas[interno] = local == deposito ? 0 : demandasArquivo[local];
+    }
+
+    instancia.custoOtimo = lerCustoOtimo(nomeArquivo);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+
+    vector<string> nomesArquivos = {
+        "../grafos/cvrplib/exemplo-n9-k4.vrp",
+    };
+    if (argc > 1)
+        nomesArquivos.assign(argv + 1, argv + argc);
+
+    for (const auto& nomeArquivo : nomesArquivos) {
+        auto tempoInicio = chrono::high_resolution_clock::now();
+
+        Instancia instancia;
+        if (!lerInstancia(nomeArquivo, instancia))
+            continue;
+
+        OtimizadorDeRota CVRP(instancia);
+        if (!CVRP.calcularMelhorRota())
+            continue;
+
+        Caminho melhorCaminho = CVRP.melhorCaminho;
+        auto tempoFim = chrono::high_resolution_clock::now();
+        auto duracao = chrono::duration_cast<chrono::milliseconds>(tempoFim - tempoInicio).count();
+        double duracaoSegundos = duracao / 1000.0;
+
+        cout << "Solucao para: " << nomeArquivo << endl;
+        if (instancia.dimensao <= 100) {
+            cout << "Sequencia de locais na melhor rota: ";
+            for (const Local& local : melhorCaminho.trajeto) cout << local << " -> ";
+            cout << "0" << endl;
+        } else {
+            cout << "Numero de retornos ao deposito: " << count(melhorCaminho.trajeto.begin() + 1, melhorCaminho.trajeto.end(), 0) << endl;
+        }
+        cout << "Custo da melhor rota: " << melhorCaminho.custoTotal << endl;
+        if (instancia.custoOtimo > 0) {
+            double gap = 100.0 * (melhorCaminho.custoTotal - instancia.custoOtimo) / instancia.custoOtimo;
+            cout << "Custo otimo conhecido: " << instancia.custoOtimo << " (gap: " << fixed << setprecision(2) << gap << "%)" << endl;
+        }
+        cout << "Tempo de exec: " << duracao << " milissegundos (" << fixed << setprecision(3) << duracaoSegundos << " segundos)." << endl;
+        cout << "--------------------------------------------------------" << endl;
+    }
+}